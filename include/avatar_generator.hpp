@@ -4,30 +4,54 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include "md5.hpp"
+#include "fast_hash.hpp"
 
 namespace hashface {
 
+/**
+ * @brief Pixel layout of a caller-supplied render target
+ */
+enum class PixelFormat {
+    RGB24,   ///< 3 bytes per pixel: R, G, B
+    RGBA32,  ///< 4 bytes per pixel: R, G, B, A (alpha = 255)
+    BGRA32,  ///< 4 bytes per pixel: B, G, R, A (alpha = 255)
+    Gray8    ///< 1 byte per pixel: luminance
+};
+
+/**
+ * @brief Get number of bytes per pixel for a pixel format
+ */
+int bytes_per_pixel(PixelFormat format);
+
 /**
  * @brief GitHub-style avatar generator
  * 
  * Generates identicon-style avatars similar to GitHub's default avatars.
- * Uses MD5 hash of input string to create deterministic patterns.
+ * Uses a hash of input string to create deterministic patterns.
+ * 
+ * @tparam Hash Hash policy providing
+ *         `static std::vector<uint8_t> hash(const std::string&)`.
+ *         MD5 (default) keeps output byte-compatible; FastHash is a faster
+ *         non-cryptographic alternative. Definitions live in
+ *         avatar_generator.tpp, so user-defined policies work too.
  */
-class AvatarGenerator {
+template <typename Hash = MD5>
+class BasicAvatarGenerator {
 public:
     /**
      * @brief Construct a new Avatar Generator
      * @param size Output image size in pixels (default 420)
      * @param grid_size Grid size for pattern (default 5x5)
      */
-    explicit AvatarGenerator(int size = 420, int grid_size = 5);
+    explicit BasicAvatarGenerator(int size = 420, int grid_size = 5);
     
     /**
      * @brief Generate avatar from input string
      * @param input String to hash (e.g., username, email)
      * @return Vector of bytes representing PNG image data
      */
-    std::vector<uint8_t> generate(const std::string& input);
+    std::vector<uint8_t> generate(const std::string& input) const;
     
     /**
      * @brief Generate avatar and save to file
@@ -37,6 +61,53 @@ public:
      */
     bool generate_to_file(const std::string& input, const std::string& filename);
     
+    /**
+     * @brief Render avatar directly into a caller-owned buffer
+     * 
+     * Writes a tile_size() x tile_size() square without any intermediate
+     * pixel buffer; pixels outside the square are left untouched. Does not
+     * modify the generator, so it may be called concurrently on one object.
+     * @param input String to hash
+     * @param buffer Pointer to the first row of the destination image
+     * @param stride Distance in bytes between consecutive rows of buffer
+     * @param format Pixel format of buffer
+     * @param x Destination column of the avatar's left edge, in pixels
+     * @param y Destination row of the avatar's top edge, in pixels
+     * @throws std::invalid_argument if buffer is null, the offset is
+     *         negative or a row of the avatar does not fit into stride
+     */
+    void render(const std::string& input, uint8_t* buffer, size_t stride,
+                PixelFormat format = PixelFormat::RGB24, int x = 0, int y = 0) const;
+    
+    /**
+     * @brief Generate a sprite sheet (atlas) of avatars
+     * 
+     * Tiles are rendered in parallel straight into the shared atlas buffer,
+     * laid out row-major, tile_size() pixels each. Repeated inputs share the
+     * tile of their first occurrence.
+     * @param inputs Strings to hash, one tile per distinct string
+     * @param columns Number of tiles per atlas row
+     * @return Vector of bytes representing RGB atlas pixel data
+     */
+    std::vector<uint8_t> generate_atlas(const std::vector<std::string>& inputs, int columns) const;
+    
+    /**
+     * @brief Generate atlas, save it as a single PNG and write a JSON tile map
+     * @param inputs Strings to hash, one tile per distinct string
+     * @param columns Number of tiles per atlas row
+     * @param filename Output atlas filename (should end with .png)
+     * @param map_filename Output JSON map of input to tile offset
+     * @return true on success, false on failure
+     */
+    bool generate_atlas_to_file(const std::vector<std::string>& inputs, int columns,
+                                const std::string& filename,
+                                const std::string& map_filename) const;
+    
+    /**
+     * @brief Get actual rendered avatar size (size rounded down to grid)
+     */
+    int tile_size() const;
+    
     /**
      * @brief Set custom background color
      * @param r Red component (0-255)
@@ -50,33 +121,121 @@ private:
     int grid_size_;
     uint8_t bg_r_, bg_g_, bg_b_;
     
+    /**
+     * @brief Hash input, extending the digest to cover every grid cell
+     * 
+     * The policy's digest is used as is when it is long enough, so default
+     * grids stay byte-compatible; larger grids get extra blocks hashed from
+     * a counter-prefixed input instead of repeating the first ones.
+     * @param input String to hash
+     * @return Digest bytes, at least one per mirrored grid cell
+     */
+    std::vector<uint8_t> digest(const std::string& input) const;
+    
     /**
      * @brief Get color from hash bytes
-     * @param hash MD5 hash bytes
+     * @param hash Digest bytes
      * @return RGB color packed into uint32_t
      */
-    uint32_t get_color(const std::vector<uint8_t>& hash);
+    uint32_t get_color(const std::vector<uint8_t>& hash) const;
+    
+    /**
+     * @brief Check whether a grid cell is colored
+     * 
+     * The pattern is mirrored horizontally, so only the left half (plus the
+     * middle column for odd sizes) is taken from the hash.
+     * @param hash Digest bytes
+     * @param gx Cell column
+     * @param gy Cell row
+     * @return true = colored, false = background
+     */
+    bool cell_filled(const std::vector<uint8_t>& hash, int gx, int gy) const;
     
     /**
-     * @brief Generate pixel grid from hash
-     * @param hash MD5 hash bytes
-     * @return 2D grid of boolean values (true = colored, false = background)
+     * @brief Validate atlas parameters and get effective column count
+     * @param count Number of distinct inputs
+     * @param columns Requested tiles per atlas row
+     * @return Tiles per atlas row, never more than count
+     * @throws std::invalid_argument if count or columns is zero, or the
+     *         tile would be empty (size < grid_size)
      */
-    std::vector<std::vector<bool>> generate_grid(const std::vector<uint8_t>& hash);
+    size_t atlas_columns(size_t count, int columns) const;
     
     /**
-     * @brief Write PNG file
-     * @param filename Output filename
-     * @param pixels Pixel data (RGB)
-     * @param width Image width
-     * @param height Image height
-     * @return true on success
+     * @brief Render atlas tiles into an RGB buffer
+     * @param inputs Distinct strings to hash, one tile each
+     * @param cols Tiles per atlas row
+     * @param dst Pointer to the top-left pixel of the atlas
+     * @param stride Distance in bytes between consecutive rows of dst
      */
-    bool write_png(const std::string& filename, 
-                   const std::vector<uint8_t>& pixels,
-                   int width, int height);
+    void render_atlas(const std::vector<std::string>& inputs, size_t cols,
+                      uint8_t* dst, size_t stride) const;
 };
 
+namespace detail {
+
+/**
+ * @brief Escape string for use inside a JSON string literal
+ */
+std::string json_escape(const std::string& str);
+
+/**
+ * @brief Convert packed RGB color into bytes of the given pixel format
+ */
+void encode_pixel(uint8_t* out, PixelFormat format, uint32_t color);
+
+/**
+ * @brief Repeat one pixel count times using memset / doubling memcpy
+ */
+void fill_pixels(uint8_t* dst, const uint8_t* pixel, size_t bpp, int count);
+
+/**
+ * @brief Drop repeated inputs, keeping the first occurrence of each in order
+ */
+std::vector<std::string> unique_inputs(const std::vector<std::string>& inputs);
+
+/**
+ * @brief Write PNG file
+ * @param filename Output filename
+ * @param pixels Pixel data (RGB)
+ * @param width Image width
+ * @param height Image height
+ * @return true on success
+ */
+bool write_png(const std::string& filename,
+               const std::vector<uint8_t>& pixels,
+               int width, int height);
+
+/**
+ * @brief Write PNG file from ready-made scanlines
+ * @param filename Output filename
+ * @param scanlines RGB rows, each prefixed with its filter type byte
+ * @param scanlines_size Total size of scanlines in bytes
+ * @param width Image width
+ * @param height Image height
+ * @return true on success
+ */
+bool write_png(const std::string& filename,
+               const uint8_t* scanlines, size_t scanlines_size,
+               int width, int height);
+
+} // namespace detail
+
+} // namespace hashface
+
+#include "avatar_generator.tpp"
+
+namespace hashface {
+
+extern template class BasicAvatarGenerator<MD5>;
+extern template class BasicAvatarGenerator<FastHash>;
+
+/// MD5-based generator, byte-compatible with previous releases
+using AvatarGenerator = BasicAvatarGenerator<MD5>;
+
+/// Generator using the fast non-cryptographic hash
+using FastAvatarGenerator = BasicAvatarGenerator<FastHash>;
+
 } // namespace hashface
 
 #endif // AVATAR_GENERATOR_HPP
\ No newline at end of file
@@ -0,0 +1,292 @@
+#ifndef AVATAR_GENERATOR_TPP
+#define AVATAR_GENERATOR_TPP
+
+// Template definitions for BasicAvatarGenerator, included by
+// avatar_generator.hpp so any hash policy can be instantiated.
+
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace hashface {
+
+template <typename Hash>
+BasicAvatarGenerator<Hash>::BasicAvatarGenerator(int size, int grid_size)
+    : size_(size), grid_size_(grid_size), bg_r_(255), bg_g_(255), bg_b_(255) {
+    if (size <= 0 || grid_size <= 0) {
+        throw std::invalid_argument("Size and grid_size must be positive");
+    }
+}
+
+template <typename Hash>
+void BasicAvatarGenerator<Hash>::set_background_color(uint8_t r, uint8_t g, uint8_t b) {
+    bg_r_ = r;
+    bg_g_ = g;
+    bg_b_ = b;
+}
+
+template <typename Hash>
+int BasicAvatarGenerator<Hash>::tile_size() const {
+    return (size_ / grid_size_) * grid_size_;
+}
+
+template <typename Hash>
+std::vector<uint8_t> BasicAvatarGenerator<Hash>::digest(const std::string& input) const {
+    auto hash = Hash::hash(input);
+    
+    size_t half = static_cast<size_t>((grid_size_ + 1) / 2);
+    size_t needed = static_cast<size_t>(grid_size_) * half;
+    
+    for (uint32_t block = 1; hash.size() < needed; block++) {
+        auto extra = Hash::hash(std::to_string(block) + ":" + input);
+        hash.insert(hash.end(), extra.begin(), extra.end());
+    }
+    
+    return hash;
+}
+
+template <typename Hash>
+uint32_t BasicAvatarGenerator<Hash>::get_color(const std::vector<uint8_t>& hash) const {
+    // GitHub uses the last 3 bytes of the hash for color
+    // But we'll use first 3 for more variation
+    uint8_t r = hash[0];
+    uint8_t g = hash[1];
+    uint8_t b = hash[2];
+    
+    // Ensure the color is not too light (would blend with background)
+    // and not too dark
+    double luminance = 0.299 * r + 0.587 * g + 0.114 * b;
+    
+    if (luminance > 200) {
+        // Darken
+        r = static_cast<uint8_t>(r * 0.6);
+        g = static_cast<uint8_t>(g * 0.6);
+        b = static_cast<uint8_t>(b * 0.6);
+    } else if (luminance < 55) {
+        // Lighten
+        r = static_cast<uint8_t>(std::min(255.0, r * 1.5 + 50));
+        g = static_cast<uint8_t>(std::min(255.0, g * 1.5 + 50));
+        b = static_cast<uint8_t>(std::min(255.0, b * 1.5 + 50));
+    }
+    
+    return (r << 16) | (g << 8) | b;
+}
+
+template <typename Hash>
+bool BasicAvatarGenerator<Hash>::cell_filled(const std::vector<uint8_t>& hash, int gx, int gy) const {
+    // GitHub-style: symmetric pattern
+    // Mirror right side onto left (middle column maps to itself for odd sizes)
+    int half = (grid_size_ + 1) / 2;
+    int x = std::min(gx, grid_size_ - 1 - gx);
+    
+    // Use different bytes from hash for each cell
+    size_t byte_index = static_cast<size_t>(gy * half + x) % hash.size();
+    // Use lower bit to determine if cell is filled
+    return (hash[byte_index] & 0x01) == 0;
+}
+
+template <typename Hash>
+void BasicAvatarGenerator<Hash>::render(const std::string& input, uint8_t* buffer, size_t stride,
+                                        PixelFormat format, int x, int y) const {
+    int tile = tile_size();
+    size_t bpp = static_cast<size_t>(bytes_per_pixel(format));
+    size_t row_bytes = static_cast<size_t>(tile) * bpp;
+    
+    // size < grid_size leaves nothing to draw
+    if (tile == 0) return;
+    
+    if (!buffer) {
+        throw std::invalid_argument("Render buffer must not be null");
+    }
+    if (x < 0 || y < 0) {
+        throw std::invalid_argument("Render offset must not be negative");
+    }
+    if (static_cast<size_t>(x) * bpp + row_bytes > stride) {
+        throw std::invalid_argument("Render stride is too small for avatar row");
+    }
+    
+    auto hash = digest(input);
+    
+    // Get color from hash
+    uint8_t fg[4], bg[4];
+    detail::encode_pixel(fg, format, get_color(hash));
+    detail::encode_pixel(bg, format, (static_cast<uint32_t>(bg_r_) << 16) | (bg_g_ << 8) | bg_b_);
+    
+    int cell_size = size_ / grid_size_;
+    uint8_t* dst = buffer + static_cast<size_t>(y) * stride + static_cast<size_t>(x) * bpp;
+    
+    for (int gy = 0; gy < grid_size_; gy++) {
+        uint8_t* band = dst + static_cast<size_t>(gy) * cell_size * stride;
+        
+        // Fill the first scanline of this grid row
+        uint8_t* p = band;
+        for (int gx = 0; gx < grid_size_; gx++) {
+            detail::fill_pixels(p, cell_filled(hash, gx, gy) ? fg : bg, bpp, cell_size);
+            p += static_cast<size_t>(cell_size) * bpp;
+        }
+        
+        // Every other scanline of the cell is identical
+        for (int cy = 1; cy < cell_size; cy++) {
+            std::memcpy(band + cy * stride, band, row_bytes);
+        }
+    }
+}
+
+template <typename Hash>
+std::vector<uint8_t> BasicAvatarGenerator<Hash>::generate(const std::string& input) const {
+    int actual_size = tile_size();
+    
+    // Create pixel buffer (RGB)
+    std::vector<uint8_t> pixels(actual_size * actual_size * 3);
+    render(input, pixels.data(), static_cast<size_t>(actual_size) * 3, PixelFormat::RGB24);
+    
+    return pixels;
+}
+
+template <typename Hash>
+bool BasicAvatarGenerator<Hash>::generate_to_file(const std::string& input, const std::string& filename) {
+    auto pixels = generate(input);
+    int actual_size = tile_size();
+    return detail::write_png(filename, pixels, actual_size, actual_size);
+}
+
+template <typename Hash>
+size_t BasicAvatarGenerator<Hash>::atlas_columns(size_t count, int columns) const {
+    if (count == 0) {
+        throw std::invalid_argument("Atlas requires at least one input");
+    }
+    if (columns <= 0) {
+        throw std::invalid_argument("Atlas columns must be positive");
+    }
+    if (tile_size() == 0) {
+        throw std::invalid_argument("Atlas tile size is zero: size must be at least grid_size");
+    }
+    return std::min(static_cast<size_t>(columns), count);
+}
+
+template <typename Hash>
+void BasicAvatarGenerator<Hash>::render_atlas(const std::vector<std::string>& inputs, size_t cols,
+                                              uint8_t* dst, size_t stride) const {
+    size_t count = inputs.size();
+    size_t rows = (count + cols - 1) / cols;
+    size_t tile = static_cast<size_t>(tile_size());
+    
+    // Empty slots in the last atlas row get the background color
+    if (count % cols != 0) {
+        uint8_t bg[4];
+        detail::encode_pixel(bg, PixelFormat::RGB24, (static_cast<uint32_t>(bg_r_) << 16) | (bg_g_ << 8) | bg_b_);
+        
+        size_t used = (count % cols) * tile;
+        size_t empty_bytes = (cols * tile - used) * 3;
+        uint8_t* band = dst + (rows - 1) * tile * stride + used * 3;
+        
+        detail::fill_pixels(band, bg, 3, static_cast<int>(cols * tile - used));
+        for (size_t y = 1; y < tile; y++) {
+            std::memcpy(band + y * stride, band, empty_bytes);
+        }
+    }
+    
+    // Tiles cover disjoint regions, so workers can write without locking.
+    // The first exception stops all workers and is rethrown after joining.
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    
+    auto worker = [&]() {
+        try {
+            for (size_t i = next++; i < count && !failed; i = next++) {
+                int tx = static_cast<int>((i % cols) * tile);
+                int ty = static_cast<int>((i / cols) * tile);
+                render(inputs[i], dst, stride, PixelFormat::RGB24, tx, ty);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) error = std::current_exception();
+            failed = true;
+        }
+    };
+    
+    size_t workers = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count);
+    std::vector<std::thread> threads;
+    try {
+        for (size_t t = 1; t < workers; t++) {
+            threads.emplace_back(worker);
+        }
+    } catch (...) {
+        // Could not spawn more threads; finish with the ones we have
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+template <typename Hash>
+std::vector<uint8_t> BasicAvatarGenerator<Hash>::generate_atlas(const std::vector<std::string>& all_inputs, int columns) const {
+    auto inputs = detail::unique_inputs(all_inputs);
+    size_t cols = atlas_columns(inputs.size(), columns);
+    size_t rows = (inputs.size() + cols - 1) / cols;
+    size_t tile = static_cast<size_t>(tile_size());
+    size_t stride = cols * tile * 3;
+    
+    std::vector<uint8_t> pixels(stride * rows * tile);
+    render_atlas(inputs, cols, pixels.data(), stride);
+    
+    return pixels;
+}
+
+template <typename Hash>
+bool BasicAvatarGenerator<Hash>::generate_atlas_to_file(const std::vector<std::string>& all_inputs, int columns,
+                                                         const std::string& filename,
+                                                         const std::string& map_filename) const {
+    auto inputs = detail::unique_inputs(all_inputs);
+    int cols = static_cast<int>(atlas_columns(inputs.size(), columns));
+    int rows = static_cast<int>((inputs.size() + cols - 1) / cols);
+    int tile = tile_size();
+    
+    // Render straight into PNG scanlines: every row starts with a filter
+    // type byte, left zero (no filter), so the buffer is compressed as is
+    size_t row_bytes = static_cast<size_t>(cols) * tile * 3;
+    size_t height = static_cast<size_t>(rows) * tile;
+    std::vector<uint8_t> scanlines((row_bytes + 1) * height, 0);
+    render_atlas(inputs, cols, scanlines.data() + 1, row_bytes + 1);
+    
+    if (!detail::write_png(filename, scanlines.data(), scanlines.size(), cols * tile, rows * tile)) {
+        return false;
+    }
+    
+    std::ofstream map(map_filename);
+    if (!map) return false;
+    
+    map << "{\n";
+    map << "  \"image\": \"" << detail::json_escape(filename) << "\",\n";
+    map << "  \"width\": " << cols * tile << ",\n";
+    map << "  \"height\": " << rows * tile << ",\n";
+    map << "  \"tile_size\": " << tile << ",\n";
+    map << "  \"columns\": " << cols << ",\n";
+    map << "  \"tiles\": {";
+    for (size_t i = 0; i < inputs.size(); i++) {
+        map << (i == 0 ? "\n" : ",\n");
+        map << "    \"" << detail::json_escape(inputs[i]) << "\": {\"x\": "
+            << static_cast<int>(i % cols) * tile << ", \"y\": "
+            << static_cast<int>(i / cols) * tile << "}";
+    }
+    map << "\n  }\n";
+    map << "}\n";
+    
+    return map.good();
+}
+
+} // namespace hashface
+
+#endif // AVATAR_GENERATOR_TPP
\ No newline at end of file
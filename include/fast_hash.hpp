@@ -0,0 +1,40 @@
+#ifndef FAST_HASH_HPP
+#define FAST_HASH_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace hashface {
+
+/**
+ * @brief Fast non-cryptographic 128-bit hash
+ * 
+ * xxHash3-style construction: 16-byte stripes are mixed with a secret via
+ * 64x64->128 bit multiply-fold, then avalanched. Digests are NOT compatible
+ * with the reference XXH3 implementation.
+ */
+class FastHash {
+public:
+    static constexpr const char* name = "Fast";
+    
+    /**
+     * @brief Compute 128-bit hash of data
+     * @return 16-byte hash
+     */
+    static std::vector<uint8_t> hash(const uint8_t* data, size_t len);
+    
+    /**
+     * @brief Compute 128-bit hash of string in one call
+     */
+    static std::vector<uint8_t> hash(const std::string& input);
+    
+    /**
+     * @brief Convert hash bytes to hexadecimal string
+     */
+    static std::string to_hex(const std::vector<uint8_t>& hash);
+};
+
+} // namespace hashface
+
+#endif // FAST_HASH_HPP
\ No newline at end of file
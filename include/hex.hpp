@@ -0,0 +1,17 @@
+#ifndef HEX_HPP
+#define HEX_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace hashface {
+
+/**
+ * @brief Convert bytes to lowercase hexadecimal string
+ */
+std::string to_hex(const std::vector<uint8_t>& bytes);
+
+} // namespace hashface
+
+#endif // HEX_HPP
\ No newline at end of file
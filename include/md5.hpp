@@ -12,6 +12,8 @@ namespace hashface {
  */
 class MD5 {
 public:
+    static constexpr const char* name = "MD5";
+    
     MD5();
     
     /**
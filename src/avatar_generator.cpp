@@ -1,9 +1,9 @@
 #include "avatar_generator.hpp"
-#include "md5.hpp"
 #include <fstream>
 #include <stdexcept>
-#include <cmath>
 #include <algorithm>
+#include <cstring>
+#include <unordered_set>
 #include <zlib.h>
 
 namespace hashface {
@@ -67,71 +67,117 @@ static std::vector<uint8_t> create_png_chunk(const std::string& type, const std:
     return chunk;
 }
 
-AvatarGenerator::AvatarGenerator(int size, int grid_size)
-    : size_(size), grid_size_(grid_size), bg_r_(255), bg_g_(255), bg_b_(255) {
-    if (size <= 0 || grid_size <= 0) {
-        throw std::invalid_argument("Size and grid_size must be positive");
+int bytes_per_pixel(PixelFormat format) {
+    switch (format) {
+        case PixelFormat::RGB24:  return 3;
+        case PixelFormat::RGBA32: return 4;
+        case PixelFormat::BGRA32: return 4;
+        case PixelFormat::Gray8:  return 1;
     }
+    throw std::invalid_argument("Unknown pixel format");
 }
 
-void AvatarGenerator::set_background_color(uint8_t r, uint8_t g, uint8_t b) {
-    bg_r_ = r;
-    bg_g_ = g;
-    bg_b_ = b;
+namespace detail {
+
+std::string json_escape(const std::string& str) {
+    static const char hex[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(str.size() + 2);
+    
+    for (char ch : str) {
+        uint8_t c = static_cast<uint8_t>(ch);
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    out += "\\u00";
+                    out += hex[c >> 4];
+                    out += hex[c & 0x0f];
+                } else {
+                    out += ch;
+                }
+        }
+    }
+    
+    return out;
+}
+
+void encode_pixel(uint8_t* out, PixelFormat format, uint32_t color) {
+    uint8_t r = (color >> 16) & 0xff;
+    uint8_t g = (color >> 8) & 0xff;
+    uint8_t b = color & 0xff;
+    
+    switch (format) {
+        case PixelFormat::RGB24:
+            out[0] = r; out[1] = g; out[2] = b;
+            break;
+        case PixelFormat::RGBA32:
+            out[0] = r; out[1] = g; out[2] = b; out[3] = 255;
+            break;
+        case PixelFormat::BGRA32:
+            out[0] = b; out[1] = g; out[2] = r; out[3] = 255;
+            break;
+        case PixelFormat::Gray8:
+            out[0] = static_cast<uint8_t>((299 * r + 587 * g + 114 * b + 500) / 1000);
+            break;
+    }
 }
 
-uint32_t AvatarGenerator::get_color(const std::vector<uint8_t>& hash) {
-    // GitHub uses the last 3 bytes of the hash for color
-    // But we'll use first 3 for more variation
-    uint8_t r = hash[0];
-    uint8_t g = hash[1];
-    uint8_t b = hash[2];
-    
-    // Ensure the color is not too light (would blend with background)
-    // and not too dark
-    double luminance = 0.299 * r + 0.587 * g + 0.114 * b;
-    
-    if (luminance > 200) {
-        // Darken
-        r = static_cast<uint8_t>(r * 0.6);
-        g = static_cast<uint8_t>(g * 0.6);
-        b = static_cast<uint8_t>(b * 0.6);
-    } else if (luminance < 55) {
-        // Lighten
-        r = static_cast<uint8_t>(std::min(255.0, r * 1.5 + 50));
-        g = static_cast<uint8_t>(std::min(255.0, g * 1.5 + 50));
-        b = static_cast<uint8_t>(std::min(255.0, b * 1.5 + 50));
+// Repeat one pixel count times; the copy doubles each step so long runs
+// go through memcpy/memset instead of a per-byte loop
+void fill_pixels(uint8_t* dst, const uint8_t* pixel, size_t bpp, int count) {
+    if (count <= 0) return;
+    if (bpp == 1) {
+        std::memset(dst, pixel[0], static_cast<size_t>(count));
+        return;
     }
     
-    return (r << 16) | (g << 8) | b;
+    size_t total = bpp * static_cast<size_t>(count);
+    std::memcpy(dst, pixel, bpp);
+    for (size_t filled = bpp; filled < total; ) {
+        size_t n = std::min(filled, total - filled);
+        std::memcpy(dst + filled, dst, n);
+        filled += n;
+    }
 }
 
-std::vector<std::vector<bool>> AvatarGenerator::generate_grid(const std::vector<uint8_t>& hash) {
-    std::vector<std::vector<bool>> grid(grid_size_, std::vector<bool>(grid_size_, false));
-    
-    // GitHub-style: symmetric pattern
-    // Use hash bits to determine which cells are filled
-    int half = (grid_size_ + 1) / 2;
-    
-    for (int y = 0; y < grid_size_; y++) {
-        for (int x = 0; x < half; x++) {
-            // Use different bytes from hash for each cell
-            int byte_index = (y * half + x) % hash.size();
-            // Use lower bit to determine if cell is filled
-            bool filled = (hash[byte_index] & 0x01) == 0;
-            
-            grid[y][x] = filled;
-            // Mirror to right side (except middle column for odd sizes)
-            grid[y][grid_size_ - 1 - x] = filled;
+std::vector<std::string> unique_inputs(const std::vector<std::string>& inputs) {
+    std::vector<std::string> unique;
+    std::unordered_set<std::string> seen;
+    unique.reserve(inputs.size());
+    
+    for (const auto& input : inputs) {
+        if (seen.insert(input).second) {
+            unique.push_back(input);
         }
     }
     
-    return grid;
+    return unique;
+}
+
+bool write_png(const std::string& filename,
+               const std::vector<uint8_t>& pixels,
+               int width, int height) {
+    // Prepare raw image data with filter bytes
+    size_t row_bytes = static_cast<size_t>(width) * 3;
+    std::vector<uint8_t> raw_data;
+    raw_data.reserve((row_bytes + 1) * height);
+    for (int y = 0; y < height; y++) {
+        raw_data.push_back(0);  // No filter for this row
+        const uint8_t* row = pixels.data() + y * row_bytes;
+        raw_data.insert(raw_data.end(), row, row + row_bytes);
+    }
+    
+    return write_png(filename, raw_data.data(), raw_data.size(), width, height);
 }
 
-bool AvatarGenerator::write_png(const std::string& filename,
-                                 const std::vector<uint8_t>& pixels,
-                                 int width, int height) {
+bool write_png(const std::string& filename,
+               const uint8_t* scanlines, size_t scanlines_size,
+               int width, int height) {
     std::ofstream file(filename, std::ios::binary);
     if (!file) return false;
     
@@ -154,21 +200,12 @@ bool AvatarGenerator::write_png(const std::string& filename,
     auto ihdr_chunk = create_png_chunk("IHDR", ihdr_data);
     png_data.insert(png_data.end(), ihdr_chunk.begin(), ihdr_chunk.end());
     
-    // Prepare raw image data with filter bytes
-    std::vector<uint8_t> raw_data;
-    for (int y = 0; y < height; y++) {
-        raw_data.push_back(0);  // No filter for this row
-        for (int x = 0; x < width * 3; x++) {
-            raw_data.push_back(pixels[y * width * 3 + x]);
-        }
-    }
-    
     // Compress with zlib
-    uLongf compressed_size = compressBound(raw_data.size());
+    uLongf compressed_size = compressBound(scanlines_size);
     std::vector<uint8_t> compressed(compressed_size);
     
     if (compress2(compressed.data(), &compressed_size,
-                  raw_data.data(), raw_data.size(), 9) != Z_OK) {
+                  scanlines, scanlines_size, 9) != Z_OK) {
         return false;
     }
     compressed.resize(compressed_size);
@@ -185,59 +222,9 @@ bool AvatarGenerator::write_png(const std::string& filename,
     return file.good();
 }
 
-std::vector<uint8_t> AvatarGenerator::generate(const std::string& input) {
-    // Compute MD5 hash
-    auto hash = MD5::hash(input);
-    
-    // Get color from hash
-    uint32_t color = get_color(hash);
-    uint8_t cr = (color >> 16) & 0xff;
-    uint8_t cg = (color >> 8) & 0xff;
-    uint8_t cb = color & 0xff;
-    
-    // Generate pattern grid
-    auto grid = generate_grid(hash);
-    
-    // Calculate cell size
-    int cell_size = size_ / grid_size_;
-    int actual_size = cell_size * grid_size_;
-    
-    // Create pixel buffer (RGB)
-    std::vector<uint8_t> pixels(actual_size * actual_size * 3);
-    
-    // Fill pixels
-    for (int gy = 0; gy < grid_size_; gy++) {
-        for (int gx = 0; gx < grid_size_; gx++) {
-            bool filled = grid[gy][gx];
-            
-            for (int cy = 0; cy < cell_size; cy++) {
-                for (int cx = 0; cx < cell_size; cx++) {
-                    int px = gx * cell_size + cx;
-                    int py = gy * cell_size + cy;
-                    int idx = (py * actual_size + px) * 3;
-                    
-                    if (filled) {
-                        pixels[idx] = cr;
-                        pixels[idx + 1] = cg;
-                        pixels[idx + 2] = cb;
-                    } else {
-                        pixels[idx] = bg_r_;
-                        pixels[idx + 1] = bg_g_;
-                        pixels[idx + 2] = bg_b_;
-                    }
-                }
-            }
-        }
-    }
-    
-    return pixels;
-}
+} // namespace detail
 
-bool AvatarGenerator::generate_to_file(const std::string& input, const std::string& filename) {
-    auto pixels = generate(input);
-    int cell_size = size_ / grid_size_;
-    int actual_size = cell_size * grid_size_;
-    return write_png(filename, pixels, actual_size, actual_size);
-}
+template class BasicAvatarGenerator<MD5>;
+template class BasicAvatarGenerator<FastHash>;
 
 } // namespace hashface
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "fast_hash.hpp"
+#include "hex.hpp"
+#include <cstring>
+
+namespace hashface {
+
+static const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME_MX = 0x165667919E3779F9ULL;
+
+// Secret keys, one pair per stripe position
+static const uint64_t SECRET[8] = {
+    0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL,
+    0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+    0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL,
+    0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL
+};
+
+static inline uint64_t read_le64(const uint8_t* p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+#else
+    return static_cast<uint64_t>(p[0]) |
+           (static_cast<uint64_t>(p[1]) << 8) |
+           (static_cast<uint64_t>(p[2]) << 16) |
+           (static_cast<uint64_t>(p[3]) << 24) |
+           (static_cast<uint64_t>(p[4]) << 32) |
+           (static_cast<uint64_t>(p[5]) << 40) |
+           (static_cast<uint64_t>(p[6]) << 48) |
+           (static_cast<uint64_t>(p[7]) << 56);
+#endif
+}
+
+static inline void write_le64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) {
+        p[i] = static_cast<uint8_t>(v >> (i * 8));
+    }
+}
+
+static inline uint64_t rotl64(uint64_t x, int n) {
+    return (x << n) | (x >> (64 - n));
+}
+
+// Multiply two 64-bit values and fold the 128-bit product into 64 bits
+static inline uint64_t mul128_fold64(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 product = static_cast<uint128>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t a_lo = a & 0xffffffff, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xffffffff, b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi;
+    uint64_t hi_hi = a_hi * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+    uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+    uint64_t lower = (cross << 32) | (lo_lo & 0xffffffff);
+    return lower ^ upper;
+#endif
+}
+
+static inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= PRIME_MX;
+    h ^= h >> 32;
+    return h;
+}
+
+// Mix one 16-byte stripe into both accumulators. lo and hi never read
+// each other here, so consecutive stripes overlap in the pipeline.
+static inline void accumulate(uint64_t& lo, uint64_t& hi, const uint8_t* p, const uint64_t* s) {
+    uint64_t a = read_le64(p);
+    uint64_t b = read_le64(p + 8);
+    lo += mul128_fold64(a ^ s[0], b ^ s[1]);
+    hi += mul128_fold64(b ^ s[0], rotl64(a, 31) ^ s[1]);
+}
+
+std::vector<uint8_t> FastHash::hash(const uint8_t* data, size_t len) {
+    // Mix length as 64 bits so digests match on 32- and 64-bit builds
+    uint64_t len64 = static_cast<uint64_t>(len);
+    uint64_t lo = len64 * PRIME64_1;
+    uint64_t hi = ~len64 * PRIME64_2;
+    
+    // Four stripes per block, one secret pair each
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        accumulate(lo, hi, data + i, &SECRET[0]);
+        accumulate(lo, hi, data + i + 16, &SECRET[2]);
+        accumulate(lo, hi, data + i + 32, &SECRET[4]);
+        accumulate(lo, hi, data + i + 48, &SECRET[6]);
+    }
+    
+    size_t stripe = 0;
+    for (; i + 16 <= len; i += 16) {
+        accumulate(lo, hi, data + i, &SECRET[(stripe++ % 4) * 2]);
+    }
+    
+    // Tail (and empty input) goes through a zero-padded stripe
+    uint8_t tail[16] = {0};
+    if (len > i) {
+        std::memcpy(tail, data + i, len - i);
+    }
+    tail[15] ^= static_cast<uint8_t>(len - i);
+    accumulate(lo, hi, tail, &SECRET[(stripe % 4) * 2]);
+    
+    // Accumulators are only combined here
+    lo = avalanche(lo ^ rotl64(hi, 29));
+    hi = avalanche(hi + lo * PRIME64_2);
+    
+    std::vector<uint8_t> digest(16);
+    write_le64(digest.data(), lo);
+    write_le64(digest.data() + 8, hi);
+    return digest;
+}
+
+std::vector<uint8_t> FastHash::hash(const std::string& input) {
+    return hash(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+}
+
+std::string FastHash::to_hex(const std::vector<uint8_t>& hash) {
+    return hashface::to_hex(hash);
+}
+
+} // namespace hashface
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "hex.hpp"
+#include <sstream>
+#include <iomanip>
+
+namespace hashface {
+
+std::string to_hex(const std::vector<uint8_t>& bytes) {
+    std::ostringstream oss;
+    oss << std::hex << std::setfill('0');
+    
+    for (uint8_t byte : bytes) {
+        oss << std::setw(2) << static_cast<int>(byte);
+    }
+    
+    return oss.str();
+}
+
+} // namespace hashface
\ No newline at end of file
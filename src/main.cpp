@@ -1,8 +1,22 @@
 #include <iostream>
 #include <string>
 #include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <unordered_set>
 #include "avatar_generator.hpp"
 #include "md5.hpp"
+#include "fast_hash.hpp"
+
+struct Options {
+    std::string output_file = "avatar.png";
+    std::string input_string;
+    std::string atlas_map;
+    std::vector<std::string> inputs;
+    int size = 420;
+    int grid_size = 5;
+    int columns = 10;
+};
 
 void print_usage(const char* program_name) {
     std::cout << "HashFace - GitHub-style Avatar Generator\n\n";
@@ -11,18 +25,69 @@ void print_usage(const char* program_name) {
     std::cout << "  -o <file>     Output filename (default: avatar.png)\n";
     std::cout << "  -s <size>     Image size in pixels (default: 420)\n";
     std::cout << "  -g <grid>     Grid size (default: 5)\n";
+    std::cout << "  -a <map>      Atlas mode: render all inputs into one image,\n";
+    std::cout << "                write JSON tile map to <map>\n";
+    std::cout << "  -c <columns>  Atlas tiles per row (default: 10)\n";
+    std::cout << "  --hash <name> Hash function: md5 or fast (default: md5)\n";
     std::cout << "  -h, --help    Show this help message\n\n";
     std::cout << "Examples:\n";
     std::cout << "  " << program_name << " \"john@example.com\"\n";
     std::cout << "  " << program_name << " -o user123.png -s 256 \"user123\"\n";
     std::cout << "  " << program_name << " -g 7 \"octocat\"\n";
+    std::cout << "  " << program_name << " --hash fast \"octocat\"\n";
+    std::cout << "  " << program_name << " -a atlas.json -o atlas.png -s 64 alice bob carol\n";
+}
+
+template <typename Hash>
+int run(const Options& opts) {
+    try {
+        // Create generator
+        hashface::BasicAvatarGenerator<Hash> generator(opts.size, opts.grid_size);
+        
+        if (!opts.atlas_map.empty()) {
+            // Repeated inputs share one tile
+            std::unordered_set<std::string> distinct(opts.inputs.begin(), opts.inputs.end());
+            std::cout << "Tiles: " << distinct.size() << "\n";
+            std::cout << "Tile:  " << generator.tile_size() << "x" << generator.tile_size() << " pixels\n";
+            std::cout << "Grid:  " << opts.grid_size << "x" << opts.grid_size << "\n";
+            std::cout << "Hash:  " << Hash::name << "\n";
+            
+            if (generator.generate_atlas_to_file(opts.inputs, opts.columns, opts.output_file, opts.atlas_map)) {
+                std::cout << "Saved: " << opts.output_file << "\n";
+                std::cout << "Map:   " << opts.atlas_map << "\n";
+                return 0;
+            } else {
+                std::cerr << "Error: Failed to write output file\n";
+                return 1;
+            }
+        }
+        
+        // Show hash
+        auto hash = Hash::hash(opts.input_string);
+        std::string label = std::string(Hash::name) + ":";
+        label.resize(std::max<size_t>(label.size() + 1, 7), ' ');
+        std::cout << "Input: " << opts.input_string << "\n";
+        std::cout << label << Hash::to_hex(hash) << "\n";
+        std::cout << "Size:  " << opts.size << "x" << opts.size << " pixels\n";
+        std::cout << "Grid:  " << opts.grid_size << "x" << opts.grid_size << "\n";
+        
+        // Generate avatar
+        if (generator.generate_to_file(opts.input_string, opts.output_file)) {
+            std::cout << "Saved: " << opts.output_file << "\n";
+            return 0;
+        } else {
+            std::cerr << "Error: Failed to write output file\n";
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
 }
 
 int main(int argc, char* argv[]) {
-    std::string output_file = "avatar.png";
-    std::string input_string;
-    int size = 420;
-    int grid_size = 5;
+    Options opts;
+    std::string hash_name = "md5";
     
     // Parse arguments
     for (int i = 1; i < argc; i++) {
@@ -36,14 +101,14 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Error: -o requires a filename argument\n";
                 return 1;
             }
-            output_file = argv[++i];
+            opts.output_file = argv[++i];
         } else if (arg == "-s") {
             if (i + 1 >= argc) {
                 std::cerr << "Error: -s requires a size argument\n";
                 return 1;
             }
-            size = std::atoi(argv[++i]);
-            if (size <= 0) {
+            opts.size = std::atoi(argv[++i]);
+            if (opts.size <= 0) {
                 std::cerr << "Error: size must be positive\n";
                 return 1;
             }
@@ -52,13 +117,40 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Error: -g requires a grid size argument\n";
                 return 1;
             }
-            grid_size = std::atoi(argv[++i]);
-            if (grid_size <= 0) {
+            opts.grid_size = std::atoi(argv[++i]);
+            if (opts.grid_size <= 0) {
                 std::cerr << "Error: grid size must be positive\n";
                 return 1;
             }
+        } else if (arg == "-a") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: -a requires a map filename argument\n";
+                return 1;
+            }
+            opts.atlas_map = argv[++i];
+        } else if (arg == "-c") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: -c requires a columns argument\n";
+                return 1;
+            }
+            opts.columns = std::atoi(argv[++i]);
+            if (opts.columns <= 0) {
+                std::cerr << "Error: columns must be positive\n";
+                return 1;
+            }
+        } else if (arg == "--hash") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --hash requires a hash name argument\n";
+                return 1;
+            }
+            hash_name = argv[++i];
+            if (hash_name != "md5" && hash_name != "fast") {
+                std::cerr << "Error: unknown hash: " << hash_name << "\n";
+                return 1;
+            }
         } else if (arg[0] != '-') {
-            input_string = arg;
+            opts.input_string = arg;
+            opts.inputs.push_back(arg);
         } else {
             std::cerr << "Error: Unknown option: " << arg << "\n";
             print_usage(argv[0]);
@@ -66,33 +158,14 @@ int main(int argc, char* argv[]) {
         }
     }
     
-    if (input_string.empty()) {
+    if (opts.input_string.empty()) {
         std::cerr << "Error: No input string provided\n\n";
         print_usage(argv[0]);
         return 1;
     }
     
-    try {
-        // Create generator
-        hashface::AvatarGenerator generator(size, grid_size);
-        
-        // Show hash
-        auto hash = hashface::MD5::hash(input_string);
-        std::cout << "Input: " << input_string << "\n";
-        std::cout << "MD5:   " << hashface::MD5::to_hex(hash) << "\n";
-        std::cout << "Size:  " << size << "x" << size << " pixels\n";
-        std::cout << "Grid:  " << grid_size << "x" << grid_size << "\n";
-        
-        // Generate avatar
-        if (generator.generate_to_file(input_string, output_file)) {
-            std::cout << "Saved: " << output_file << "\n";
-            return 0;
-        } else {
-            std::cerr << "Error: Failed to write output file\n";
-            return 1;
-        }
-    } catch (const std::exception& e) {
-        std::cerr << "Error: " << e.what() << "\n";
-        return 1;
+    if (hash_name == "fast") {
+        return run<hashface::FastHash>(opts);
     }
+    return run<hashface::MD5>(opts);
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "md5.hpp"
-#include <sstream>
-#include <iomanip>
+#include "hex.hpp"
 #include <cstring>
 
 namespace hashface {
@@ -234,14 +233,7 @@ std::vector<uint8_t> MD5::hash(const std::string& input) {
 }
 
 std::string MD5::to_hex(const std::vector<uint8_t>& hash) {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    
-    for (uint8_t byte : hash) {
-        oss << std::setw(2) << static_cast<int>(byte);
-    }
-    
-    return oss.str();
+    return hashface::to_hex(hash);
 }
 
 } // namespace hashface
\ No newline at end of file